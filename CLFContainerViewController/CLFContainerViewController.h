@@ -64,6 +64,15 @@
 //
 @property (readonly, nonatomic) NSArray *viewControllers;
 
+// An immutable copy of the viewControllers array as of the last change made to it. Unlike viewControllers, this
+// property is safe to read from any thread.
+//
+// Removing the current view controller only takes it out of the viewControllers array once the transition away from it
+// completes. Until every such removal has completed, this property keeps its previous value, and is then updated with
+// all the changes made in the meantime. Together with staged changes being published all at once when they're
+// committed, this means it never reflects only part of a commit.
+@property (readonly, atomic, copy) NSArray *viewControllersSnapshot;
+
 // The view controller that is currently on screen or is currently being transitioned to.
 @property (readonly, nonatomic) UIViewController *currentViewController;
 
@@ -147,6 +156,54 @@
 - (void)insertViewController:(UIViewController *)viewController atIndex:(NSUInteger)index;
 - (void)removeViewController:(UIViewController *)viewController;
 
+// Moves a view controller to a new position in the viewControllers array. This does not trigger a transition, even if
+// the view controller being moved is the current view controller.
+//
+// The index must be less than the number of view controllers, just as insertViewController:atIndex:'s index must be
+// no greater than it.
+- (void)moveViewController:(UIViewController *)viewController toIndex:(NSUInteger)index;
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma mark - Staging Changes From Any Thread
+
+// Like the rest of UIKit, everything else in this class must be used from the main thread. These methods are the
+// exception, and may be called from any thread.
+//
+// Each of them stages a call to its main thread counterpart without blocking the calling thread. Everything staged
+// before the main thread's next pass through the run loop will be committed there together, in the order it was
+// staged. You can also call commitStagedChanges from the main thread to commit everything that's been staged so far
+// right away.
+//
+// Indices are resolved when the changes are committed, not when they're staged, so they may refer to a different
+// viewControllers array than the one you computed them from. Rather than raising an exception on the main thread, an
+// index that is out of range at that point is clamped to the last valid position. A staged move of a view controller
+// that is no longer in the viewControllers array, or is waiting to be removed, is ignored. Passing nil to
+// stageInsertViewController:atIndex: or stageMoveViewController:toIndex: raises an exception on the calling thread.
+//
+// Adding or inserting a view controller whose removal is still waiting on its transition cancels that removal, so
+// removing a view controller and then adding it back leaves it in the array once, at its new position.
+//
+- (void)stageAddViewController:(UIViewController *)viewController;
+- (void)stageInsertViewController:(UIViewController *)viewController atIndex:(NSUInteger)index;
+- (void)stageRemoveViewController:(UIViewController *)viewController;
+- (void)stageMoveViewController:(UIViewController *)viewController toIndex:(NSUInteger)index;
+
+- (void)commitStagedChanges;
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma mark - Staging Changes From Any Thread (for subclasses)
+
+// Stages an arbitrary change to be committed on the main thread along with the rest of the staged changes. Subclasses
+// can use this to offer staged versions of their own methods.
+- (void)stageChange:(void (^)())change;
+
+// Runs the changes in the block, and publishes viewControllersSnapshot once when they're done (and any removals they
+// started have completed) rather than after each one. Staged changes are always committed this way. Must be called on
+// the main thread.
+- (void)batchViewControllerChanges:(void (^)())changes;
+
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark - Switching View Controllers Simplified API
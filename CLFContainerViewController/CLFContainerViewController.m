@@ -30,9 +30,16 @@
 {
     NSMutableArray *_viewControllers;
 
+    dispatch_queue_t _stagingQueue;
+    NSMutableArray *_stagedChanges;
+    BOOL _batchingViewControllerChanges;
+    NSMutableArray *_viewControllersPendingRemoval;
+
     void *_navItemsContext;
 }
 
+@property (atomic, copy) NSArray *viewControllersSnapshot;
+
 @property (strong, nonatomic) UIViewController *currentViewController;
 
 @property (nonatomic) BOOL transitioning;
@@ -68,6 +75,12 @@
     [super awakeFromNib];
 
     _viewControllers = [NSMutableArray array];
+    _viewControllersSnapshot = @[];
+
+    _stagingQueue = dispatch_queue_create("com.clflesner.CLFContainerViewController.staging", DISPATCH_QUEUE_SERIAL);
+    _stagedChanges = [NSMutableArray array];
+    _viewControllersPendingRemoval = [NSMutableArray array];
+
     _animateWhenInsertingOrRemovingViewControllerAtCurrentIndex = YES;
     _preAnimateWhenInterruptingWithToTranistionToFromViewController = YES;
     _borrowNavItemContentsFromChildren = YES;
@@ -197,19 +210,29 @@
 
 - (void)addViewController:(UIViewController *)viewController
 {
-    if (viewController)
+    if (viewController) {
+        [self cancelPendingRemovalOfViewController:viewController];
         [_viewControllers addObject:viewController];
+        [self updateViewControllersSnapshot];
+    }
 }
 
 
 - (void)insertViewController:(UIViewController *)viewController atIndex:(NSUInteger)index
 {
     NSUInteger currentIndex = NSNotFound;
-    
+
+    [self cancelPendingRemovalOfViewController:viewController];
+
+    NSAssert(index <= self.viewControllers.count,
+             @"You cannot insert a view controller at index %lu when there are only %lu view controllers.",
+             (unsigned long)index, (unsigned long)self.viewControllers.count);
+
     if (self.viewControllers.count)
         currentIndex = [self.viewControllers indexOfObject:self.currentViewController];
 
     [_viewControllers insertObject:viewController atIndex:index];
+    [self updateViewControllersSnapshot];
 
     BOOL animated = self.animateWhenInsertingOrRemovingViewControllerAtCurrentIndex;
 
@@ -235,12 +258,160 @@
 
         BOOL animated = self.animateWhenInsertingOrRemovingViewControllerAtCurrentIndex;
 
+        [_viewControllersPendingRemoval addObject:viewController];
+
         [self switchToViewController:toViewController animated:animated withCompletionBlock:^(BOOL finished) {
-            [_viewControllers removeObject:viewController];
+            // If the view controller was added back while we were transitioning away from it, it stays.
+            if ([_viewControllersPendingRemoval containsObject:viewController]) {
+                [_viewControllersPendingRemoval removeObject:viewController];
+                [_viewControllers removeObject:viewController];
+            }
+
+            [self updateViewControllersSnapshot];
         }];
     }
-    else
+    else {
         [_viewControllers removeObject:viewController];
+        [self updateViewControllersSnapshot];
+    }
+}
+
+
+- (void)moveViewController:(UIViewController *)viewController toIndex:(NSUInteger)index
+{
+    NSAssert([self.viewControllers containsObject:viewController],
+             @"You cannot move a view controller that has not been added using addViewController:");
+    NSAssert(index < self.viewControllers.count,
+             @"You cannot move a view controller to index %lu when there are only %lu view controllers.",
+             (unsigned long)index, (unsigned long)self.viewControllers.count);
+
+    // Moving a view controller only changes its position in the array. Whichever view controller is on the screen
+    // stays there.
+    [_viewControllers removeObject:viewController];
+    [_viewControllers insertObject:viewController atIndex:index];
+    [self updateViewControllersSnapshot];
+}
+
+
+- (void)cancelPendingRemovalOfViewController:(UIViewController *)viewController
+{
+    if ([_viewControllersPendingRemoval containsObject:viewController]) {
+        [_viewControllersPendingRemoval removeObject:viewController];
+        [_viewControllers removeObject:viewController];
+    }
+}
+
+
+- (void)batchViewControllerChanges:(void (^)())changes
+{
+    NSParameterAssert(changes);
+
+    BOOL alreadyBatching = _batchingViewControllerChanges;
+    _batchingViewControllerChanges = YES;
+
+    changes();
+
+    _batchingViewControllerChanges = alreadyBatching;
+
+    if (!alreadyBatching)
+        [self updateViewControllersSnapshot];
+}
+
+
+- (void)updateViewControllersSnapshot
+{
+    // While batching, or while a removal is waiting on its transition, the snapshot is held back and published once
+    // everything is done, so that readers on other threads never see only part of a batch.
+    if (!_batchingViewControllerChanges && !_viewControllersPendingRemoval.count)
+        self.viewControllersSnapshot = _viewControllers;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma mark - Staging
+
+- (void)stageAddViewController:(UIViewController *)viewController
+{
+    [self stageChange:^{
+        [self addViewController:viewController];
+    }];
+}
+
+
+- (void)stageInsertViewController:(UIViewController *)viewController atIndex:(NSUInteger)index
+{
+    NSParameterAssert(viewController);
+
+    // The index is resolved when the change is committed, and the viewControllers array may have changed since the
+    // caller last looked at it, so we clamp it rather than fail the whole batch.
+    [self stageChange:^{
+        // Cancel any pending removal first, so the index is clamped against the array the insert will actually see.
+        [self cancelPendingRemovalOfViewController:viewController];
+
+        NSUInteger count = self.viewControllers.count;
+        [self insertViewController:viewController atIndex:MIN(index, count)];
+    }];
+}
+
+
+- (void)stageRemoveViewController:(UIViewController *)viewController
+{
+    [self stageChange:^{
+        [self removeViewController:viewController];
+    }];
+}
+
+
+- (void)stageMoveViewController:(UIViewController *)viewController toIndex:(NSUInteger)index
+{
+    NSParameterAssert(viewController);
+
+    // Same as with inserting, the index is clamped when the change is committed. If the view controller has been
+    // removed in the meantime, there's nothing left to move.
+    [self stageChange:^{
+        if (![self.viewControllers containsObject:viewController] ||
+            [_viewControllersPendingRemoval containsObject:viewController])
+            return;
+
+        NSUInteger count = self.viewControllers.count;
+        [self moveViewController:viewController toIndex:MIN(index, count - 1)];
+    }];
+}
+
+
+- (void)stageChange:(void (^)())change
+{
+    NSParameterAssert(change);
+
+    dispatch_async(_stagingQueue, ^{
+        [_stagedChanges addObject:[change copy]];
+
+        // Only the first change staged since the last commit needs to schedule one. Everything staged before that
+        // commit runs will go out with it.
+        if (_stagedChanges.count == 1) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                [self commitStagedChanges];
+            });
+        }
+    });
+}
+
+
+- (void)commitStagedChanges
+{
+    NSAssert([NSThread isMainThread], @"Staged changes can only be committed on the main thread.");
+
+    __block NSArray *changes;
+
+    dispatch_sync(_stagingQueue, ^{
+        changes = [_stagedChanges copy];
+        [_stagedChanges removeAllObjects];
+    });
+
+    [self batchViewControllerChanges:^{
+        for (void (^change)() in changes)
+            change();
+    }];
 }
 
 
@@ -31,8 +31,9 @@
  * animationOptions:completionBlock, and the
  * popToViewController:animated:preAnimationSetup:animations:animationDurationsanimationOptions:completionBlock methods.
  *
- * This class also disables the addViewController: and removeViewController: methods, and instead automatically manages
- * the viewControllers array from within the push and pop methods.
+ * This class also disables the addViewController:, insertViewController:atIndex:, removeViewController: and
+ * moveViewController:toIndex: methods (and their stage counterparts), and instead automatically manages the
+ * viewControllers array from within the push and pop methods.
  */
 
 
@@ -132,6 +133,10 @@ typedef NS_ENUM(NSUInteger, CLFStackContainerPushPopDirections) {
 - (NSArray *)popToViewController:(UIViewController *)viewController animated:(BOOL)animated;
 - (NSArray *)popToRootViewControllerAnimated:(BOOL)animated;
 
+// Stages a call to pushViewController:animated: that can be made from any thread. See the staging methods in
+// CLFContainerViewController for details.
+- (void)stagePushViewController:(UIViewController *)viewController animated:(BOOL)animated;
+
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,19 @@
 
 
 
+#pragma mark - Private Interface
+
+@interface CLFStackContainerViewController ()
+{
+    // Maps unwind action selector names to the view controller closest to the root that responds to them, or to
+    // NSNull if no view controller in the stack does.
+    NSMutableDictionary *_unwindIndex;
+}
+
+@end
+
+
+
 #pragma mark - Implementation
 
 @implementation CLFStackContainerViewController
@@ -43,6 +56,8 @@
     NSAssert(self.viewControllers.count == 0, @"You cannot set the root view controller more than once.");
 
     [super addViewController:rootViewController];
+    [self indexPushedViewController:rootViewController];
+
     [super switchToViewController:rootViewController
                          animated:NO
                 preAnimationSetup:nil
@@ -323,6 +338,14 @@
 }
 
 
+- (void)stagePushViewController:(UIViewController *)viewController animated:(BOOL)animated
+{
+    [self stageChange:^{
+        [self pushViewController:viewController animated:animated];
+    }];
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark - Push/Pop
 
@@ -338,6 +361,8 @@
              @"You must have a root view controller set before pushing another view controller.");
 
     [super addViewController:viewController];
+    [self indexPushedViewController:viewController];
+
     [super switchToViewController:viewController
                          animated:animated
                 preAnimationSetup:preAnimationSetup
@@ -374,8 +399,12 @@
                animationDurations:animationDurations
                  animationOptions:animationOptions
                   completionBlock:^(BOOL finished) {
-        for (UIViewController *vc in poppedVCs)
-            [super removeViewController:vc];
+        [self batchViewControllerChanges:^{
+            for (UIViewController *vc in poppedVCs)
+                [super removeViewController:vc];
+        }];
+
+        [self unindexPoppedViewControllers:poppedVCs];
 
         if (completionBlock) completionBlock(finished);
     }];
@@ -391,14 +420,7 @@
                                       fromViewController:(UIViewController *)fromViewController
                                               withSender:(id)sender
 {
-    UIViewController *vcForSegue;
-
-    for (UIViewController *vc in self.viewControllers) {
-        if ([vc respondsToSelector:action]) {
-            vcForSegue = vc;
-            break;
-        }
-    }
+    UIViewController *vcForSegue = [self indexedViewControllerForUnwindSegueAction:action];
 
     if (!vcForSegue) {
         vcForSegue = [super viewControllerForUnwindSegueAction:action
@@ -420,6 +442,58 @@
 }
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma mark - Unwind Segue Index
+
+- (UIViewController *)indexedViewControllerForUnwindSegueAction:(SEL)action
+{
+    if (!_unwindIndex)
+        _unwindIndex = [NSMutableDictionary dictionary];
+
+    NSString *key = NSStringFromSelector(action);
+    id indexedVC = _unwindIndex[key];
+
+    // The first lookup for an action walks the stack once. After that the index is kept up to date by the push and
+    // pop methods, so we never have to walk it again unless the view controller we found gets popped.
+    if (!indexedVC) {
+        indexedVC = [NSNull null];
+
+        for (UIViewController *vc in self.viewControllers) {
+            if ([vc respondsToSelector:action]) {
+                indexedVC = vc;
+                break;
+            }
+        }
+
+        _unwindIndex[key] = indexedVC;
+    }
+
+    return (indexedVC == [NSNull null]) ? nil : indexedVC;
+}
+
+
+- (void)indexPushedViewController:(UIViewController *)viewController
+{
+    // Actions that already resolve to a view controller still do, since it's closer to the root than the one being
+    // pushed. We only need to check the actions that nothing in the stack has responded to yet.
+    NSArray *unresolvedKeys = [_unwindIndex allKeysForObject:[NSNull null]];
+
+    for (NSString *key in unresolvedKeys) {
+        if ([viewController respondsToSelector:NSSelectorFromString(key)])
+            _unwindIndex[key] = viewController;
+    }
+}
+
+
+- (void)unindexPoppedViewControllers:(NSArray *)poppedViewControllers
+{
+    // Actions that resolved to a popped view controller are dropped, and will be looked up again the next time
+    // they're used. (Another view controller may have been pushed while the pop was in progress.)
+    for (UIViewController *vc in poppedViewControllers)
+        [_unwindIndex removeObjectsForKeys:[_unwindIndex allKeysForObject:vc]];
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark - Disabled Methods
 
@@ -441,9 +515,45 @@
 }
 
 
+- (void)insertViewController:(UIViewController *)viewController atIndex:(NSUInteger)index
+{
+    NSAssert(NO, @"CLFStackContainerViewController will add view controllers for you when you push them.");
+}
+
+
 - (void)removeViewController:(UIViewController *)viewController
 {
     NSAssert(NO, @"CLFStackContainerViewController will remove view controllers for you when you pop them.");
 }
 
+
+- (void)moveViewController:(UIViewController *)viewController toIndex:(NSUInteger)index
+{
+    NSAssert(NO, @"CLFStackContainerViewController does not allow view controllers to be moved within the stack.");
+}
+
+
+- (void)stageAddViewController:(UIViewController *)viewController
+{
+    NSAssert(NO, @"CLFStackContainerViewController will add view controllers for you when you push them.");
+}
+
+
+- (void)stageInsertViewController:(UIViewController *)viewController atIndex:(NSUInteger)index
+{
+    NSAssert(NO, @"CLFStackContainerViewController will add view controllers for you when you push them.");
+}
+
+
+- (void)stageRemoveViewController:(UIViewController *)viewController
+{
+    NSAssert(NO, @"CLFStackContainerViewController will remove view controllers for you when you pop them.");
+}
+
+
+- (void)stageMoveViewController:(UIViewController *)viewController toIndex:(NSUInteger)index
+{
+    NSAssert(NO, @"CLFStackContainerViewController does not allow view controllers to be moved within the stack.");
+}
+
 @end
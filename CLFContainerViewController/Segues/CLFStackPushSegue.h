@@ -23,6 +23,27 @@
 #import <UIKit/UIKit.h>
 
 
+/*
+ * Pushes the destination view controller onto the source view controller's CLFStackContainerViewController.
+ *
+ * If you create the segue yourself, you can call prepareDestination ahead of time (for example when a button is
+ * touched down) so that the destination's view is already loaded and laid out by the time perform is called. Segues
+ * triggered from a storyboard are created by UIKit right before they're performed, so they can't be prepared this way.
+ *
+ * If the segue ends up being abandoned, call cancelPreparation. A preparation that hasn't run yet will be skipped. One
+ * that has already run will have the destination view's frame restored, but the view will stay loaded.
+ */
+
 @interface CLFStackPushSegue : UIStoryboardSegue
 
+#pragma mark - Properties
+
+@property (readonly, nonatomic) BOOL destinationPrepared;
+
+
+#pragma mark - Preparing the Destination
+
+- (void)prepareDestination;
+- (void)cancelPreparation;
+
 @end
\ No newline at end of file
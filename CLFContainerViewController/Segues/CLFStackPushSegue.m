@@ -24,19 +24,106 @@
 #import "CLFStackContainerViewController.h"
 
 
+#pragma mark - Private Interface
+
+@interface CLFStackPushSegue ()
+
+@property (readonly, nonatomic) CLFStackContainerViewController *stackContainer;
+
+@property (nonatomic) BOOL destinationPrepared;
+@property (nonatomic) BOOL preparationPending;
+@property (nonatomic) CGRect destinationFrameBeforePreparation;
+
+@end
+
+
+
+#pragma mark - Implementation
+
 @implementation CLFStackPushSegue
 
-- (void)perform
+#pragma mark - Setters and Getters
+
+- (CLFStackContainerViewController *)stackContainer
 {
     UIViewController *source = (UIViewController *)self.sourceViewController;
-    UIViewController *destination = (UIViewController *)self.destinationViewController;
 
     CLFStackContainerViewController *stackContainer = (CLFStackContainerViewController *)source.parentViewController;
 
     NSAssert([stackContainer isKindOfClass:[CLFStackContainerViewController class]],
               @"CLFStackPushSegue is only meant to be used with a CLFStackContainerViewController.");
 
-    [stackContainer pushViewController:destination animated:YES];
+    return stackContainer;
+}
+
+
+#pragma mark - Preparing the Destination
+
+- (void)prepareDestination
+{
+    if (self.destinationPrepared || self.preparationPending)
+        return;
+
+    self.preparationPending = YES;
+
+    // We defer the work to the next pass through the run loop so the touch that triggered it isn't held up.
+    dispatch_async(dispatch_get_main_queue(), ^{
+        if (self.preparationPending)
+            [self loadDestination];
+    });
+}
+
+
+- (void)cancelPreparation
+{
+    self.preparationPending = NO;
+
+    UIViewController *destination = (UIViewController *)self.destinationViewController;
+
+    // If the preparation already ran, put the destination's view back the way we found it. The view itself stays
+    // loaded, since there's no safe way to unload it. Once the destination has been pushed there's nothing to undo.
+    if (self.destinationPrepared && !destination.parentViewController) {
+        destination.view.frame = self.destinationFrameBeforePreparation;
+        self.destinationPrepared = NO;
+    }
+}
+
+
+- (void)loadDestination
+{
+    self.preparationPending = NO;
+
+    if (self.destinationPrepared)
+        return;
+
+    UIViewController *source = (UIViewController *)self.sourceViewController;
+    UIViewController *destination = (UIViewController *)self.destinationViewController;
+
+    // The source may have been popped since prepareDestination was called, in which case there's no container to
+    // prepare the destination for.
+    if (![source.parentViewController isKindOfClass:[CLFStackContainerViewController class]])
+        return;
+
+    UIView *view = destination.view;
+    self.destinationFrameBeforePreparation = view.frame;
+
+    view.frame = self.stackContainer.childRestingFrame;
+    [view layoutIfNeeded];
+
+    self.destinationPrepared = YES;
+}
+
+
+#pragma mark - Performing
+
+- (void)perform
+{
+    UIViewController *destination = (UIViewController *)self.destinationViewController;
+
+    // If a preparation hasn't run yet, there's no point in waiting for it.
+    self.preparationPending = NO;
+
+    [self.stackContainer pushViewController:destination animated:YES];
 }
 
 @end